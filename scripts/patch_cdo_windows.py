@@ -379,6 +379,7 @@ static int unsetenv(const char *name) {
                   "src/dcw_reader.cc",
                   "src/expr_lex.cc",
                   "src/griddes.cc",
+                  "src/griddes_cache.cc",
                   "src/merge_axis.cc",
                   "src/operators/CMOR.cc",
             ]],
@@ -27,14 +27,14 @@ Integration with Skyborn::
     from skyborn_cdo import Cdo
 """
 
-from skyborn_cdo.cdo import Cdo
+from skyborn_cdo.cdo import Cdo, CdoChain
 from skyborn_cdo._cdo_binary import get_cdo_path, get_cdo_version
-from skyborn_cdo._runner import CdoError
+from skyborn_cdo._runner import CdoError, CdoJob, CdoResult
 
 __version__ = "2.5.4.0"  # Format: CDO_VERSION.WRAPPER_VERSION
 __cdo_version__ = "2.5.4"
 __author__ = "Qianye Su"
 __email__ = "suqianye2000@gmail.com"
 
-__all__ = ["Cdo", "CdoError", "get_cdo_path", "get_cdo_version",
+__all__ = ["Cdo", "CdoChain", "CdoError", "CdoJob", "CdoResult", "get_cdo_path", "get_cdo_version",
            "__version__", "__cdo_version__"]
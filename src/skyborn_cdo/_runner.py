@@ -9,8 +9,10 @@ import subprocess
 import tempfile
 import threading
 import time
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from dataclasses import dataclass, field
 from pathlib import Path
-from typing import List, Optional, Union
+from typing import Callable, Iterable, Iterator, List, Optional, Tuple, Union
 
 # Pattern CDO prints to stderr when processing completes successfully.
 _CDO_DONE_RE = re.compile(r"Processed \d+ values? from \d+ variable")
@@ -26,6 +28,69 @@ class CdoError(Exception):
         super().__init__(message)
 
 
+@dataclass
+class CdoJob:
+    """
+    One command of a batch run with :meth:`CdoRunner.run_batch`.
+
+    Either a full command string (``cmd``, same syntax as
+    :meth:`CdoRunner.run_raw`) or the pieces used by
+    :meth:`CdoRunner.run` (``args``, ``input_files``, ``output_file``,
+    ``options``).
+    """
+
+    cmd: Optional[str] = None
+    args: List[str] = field(default_factory=list)
+    input_files: Optional[List[str]] = None
+    output_file: Optional[str] = None
+    options: Optional[List[str]] = None
+    timeout: Optional[int] = None
+    name: Optional[str] = None
+
+
+@dataclass
+class CdoResult:
+    """Outcome of one :class:`CdoJob` of a batch run."""
+
+    index: int
+    job: CdoJob
+    cmd: List[str]
+    returncode: int
+    stdout: str = ""
+    stderr: str = ""
+    elapsed: float = 0.0
+    error: Optional[CdoError] = None
+
+    @property
+    def ok(self) -> bool:
+        """True if the command finished with exit code 0."""
+        return self.error is None
+
+
+def split_core_budget(num_jobs: int, max_cores: Optional[int] = None,
+                      max_workers: Optional[int] = None,
+                      threads_per_job: Optional[int] = None) -> Tuple[int, int]:
+    """
+    Split a core budget between concurrent CDO processes and the
+    ``-P`` OpenMP threads of each process.
+
+    Returns
+    -------
+    (workers, threads)
+        Number of processes running at the same time and the ``-P``
+        value passed to each of them. ``workers * threads`` never
+        exceeds the budget.
+    """
+    cores = max(1, max_cores or os.cpu_count() or 1)
+    workers = max(1, min(num_jobs, cores, max_workers or cores))
+    if threads_per_job:
+        threads = max(1, min(threads_per_job, cores))
+        workers = max(1, min(workers, cores // threads))
+    else:
+        threads = max(1, cores // workers)
+    return workers, threads
+
+
 class CdoRunner:
     """
     Low-level CDO command executor.
@@ -53,6 +118,29 @@ class CdoRunner:
     # Process management helpers
     # -----------------------------------------------------------------
 
+    @staticmethod
+    def _split_command(cmd_string: str) -> List[str]:
+        """Split a command string, dropping a leading ``cdo``."""
+        if os.name == 'nt':
+            parts = shlex.split(cmd_string, posix=False)
+            parts = [p.strip('"').strip("'") for p in parts]
+        else:
+            parts = shlex.split(cmd_string)
+
+        # Strip leading 'cdo' if present
+        if parts and parts[0].lower() in ("cdo", "cdo.exe"):
+            parts = parts[1:]
+
+        return parts
+
+    @staticmethod
+    def _guess_output_file(cmd: List[str]) -> Optional[str]:
+        """Guess the output file: last non-option argument."""
+        for part in reversed(cmd[1:]):
+            if not part.startswith("-"):
+                return part
+        return None
+
     @staticmethod
     def _kill_proc_tree(proc: subprocess.Popen) -> None:
         """Kill a process and all its children.
@@ -86,9 +174,52 @@ class CdoRunner:
     # Core execution – with Windows exit-hang workaround
     # -----------------------------------------------------------------
 
+    @staticmethod
+    def _communicate_streaming(proc: subprocess.Popen, timeout: Optional[int],
+                               on_stderr: Callable[[str], None]) -> Tuple[str, str]:
+        """Like ``proc.communicate()``, but hands every stderr line to
+        *on_stderr* as soon as CDO writes it."""
+        stdout_chunks: list = []
+        stderr_lines: list = []
+
+        def _read_stdout():
+            for chunk in iter(lambda: proc.stdout.read(4096), ""):
+                stdout_chunks.append(chunk)
+
+        def _read_stderr():
+            for line in iter(proc.stderr.readline, ""):
+                stderr_lines.append(line)
+                try:
+                    on_stderr(line)
+                except Exception:
+                    pass
+
+        readers = [threading.Thread(target=_read_stdout, daemon=True),
+                   threading.Thread(target=_read_stderr, daemon=True)]
+        for reader in readers:
+            reader.start()
+        timed_out = False
+        try:
+            proc.wait(timeout=timeout)
+        except subprocess.TimeoutExpired:
+            timed_out = True
+        finally:
+            if proc.poll() is None:
+                CdoRunner._kill_proc_tree(proc)
+            for reader in readers:
+                reader.join(timeout=5)
+
+        # The pipes belong to the reader threads, so on a timeout the output
+        # collected so far travels with the exception instead of communicate()
+        if timed_out:
+            raise subprocess.TimeoutExpired(proc.args, timeout, "".join(stdout_chunks), "".join(stderr_lines))
+
+        return "".join(stdout_chunks), "".join(stderr_lines)
+
     def _exec(self, cmd: List[str], timeout: Optional[int],
               cmd_label: Optional[str] = None,
-              output_file: Optional[str] = None) -> subprocess.CompletedProcess:
+              output_file: Optional[str] = None,
+              on_stderr: Optional[Callable[[str], None]] = None) -> subprocess.CompletedProcess:
         """Run *cmd* and return a CompletedProcess.
 
         On all platforms the CDO binary is executed with PIPE on
@@ -113,6 +244,9 @@ class CdoRunner:
             Path to the expected output file.  Used on Windows to detect
             that CDO completed its work even when the process hangs at
             exit (stderr may be empty due to C-runtime buffering).
+        on_stderr : callable, optional
+            Called with every stderr line while CDO is running.  The
+            full stderr is still returned in the CompletedProcess.
         """
         label = cmd_label or " ".join(cmd)
         _creationflags = subprocess.CREATE_NO_WINDOW if os.name == "nt" else 0
@@ -128,18 +262,24 @@ class CdoRunner:
                     text=True,
                     env=self.env,
                 )
-                stdout, stderr = proc.communicate(timeout=timeout)
+                if on_stderr is None:
+                    stdout, stderr = proc.communicate(timeout=timeout)
+                else:
+                    stdout, stderr = self._communicate_streaming(
+                        proc, timeout, on_stderr)
                 return subprocess.CompletedProcess(
                     cmd, proc.returncode, stdout, stderr)
-            except subprocess.TimeoutExpired:
-                self._kill_proc_tree(proc)
-                try:
-                    proc.communicate(timeout=5)
-                except (subprocess.TimeoutExpired, OSError):
-                    pass
+            except subprocess.TimeoutExpired as e:
+                stderr = e.stderr or ""
+                if on_stderr is None:
+                    self._kill_proc_tree(proc)
+                    try:
+                        _, stderr = proc.communicate(timeout=5)
+                    except (subprocess.TimeoutExpired, OSError):
+                        pass
                 raise CdoError(
                     f"CDO command timed out after {timeout}s: {label}",
-                    returncode=-1, stderr="", cmd=label,
+                    returncode=-1, stderr=stderr or "", cmd=label,
                 )
             except FileNotFoundError:
                 raise CdoError(
@@ -183,10 +323,21 @@ class CdoRunner:
             except (OSError, ValueError):
                 pass
 
+        def _line_reader(pipe, buf):
+            try:
+                for line in iter(pipe.readline, b""):
+                    buf.append(line)
+                    try:
+                        on_stderr(line.decode("utf-8", errors="replace"))
+                    except Exception:
+                        pass
+            except (OSError, ValueError):
+                pass
+
         tout = threading.Thread(target=_reader,
                                 args=(proc.stdout, stdout_chunks),
                                 daemon=True)
-        terr = threading.Thread(target=_reader,
+        terr = threading.Thread(target=_line_reader if on_stderr else _reader,
                                 args=(proc.stderr, stderr_chunks),
                                 daemon=True)
         tout.start()
@@ -400,30 +551,13 @@ class CdoRunner:
         CdoError
             If CDO exits with non-zero return code.
         """
-        if os.name == 'nt':
-            parts = shlex.split(cmd_string, posix=False)
-            parts = [p.strip('"').strip("'") for p in parts]
-        else:
-            parts = shlex.split(cmd_string)
-
-        # Strip leading 'cdo' if present
-        if parts and parts[0].lower() in ("cdo", "cdo.exe"):
-            parts = parts[1:]
-
-        cmd = [self.cdo_path] + parts
+        cmd = [self.cdo_path] + self._split_command(cmd_string)
 
         if self.debug:
             print(f"[skyborn-cdo] Running: {' '.join(cmd)}")
 
-        # Guess the output file: last non-option argument.
-        _outf = None
-        for _p in reversed(cmd[1:]):
-            if not _p.startswith("-"):
-                _outf = _p
-                break
-
         result = self._exec(cmd, timeout, cmd_label=cmd_string,
-                            output_file=_outf)
+                            output_file=self._guess_output_file(cmd))
 
         if result.returncode != 0:
             raise CdoError(
@@ -436,3 +570,136 @@ class CdoRunner:
             )
 
         return result
+
+    # -----------------------------------------------------------------
+    # Batch execution
+    # -----------------------------------------------------------------
+
+    def _job_command(self, job: Union[str, CdoJob], threads: int) -> List[str]:
+        """Build the command line of a batch job with ``-P threads``."""
+        if isinstance(job, str):
+            parts = self._split_command(job)
+        elif job.cmd is not None:
+            parts = self._split_command(job.cmd)
+        else:
+            parts = list(job.options or []) + list(job.args)
+            parts += list(job.input_files or [])
+            if job.output_file:
+                parts.append(job.output_file)
+
+        # Keep an explicit -P of the job, CDO only runs 1 thread by default
+        has_threads = any(p == "-P" or p.startswith("--num_threads") for p in parts)
+        if threads > 1 and not has_threads:
+            parts = ["-P", str(threads)] + parts
+
+        return [self.cdo_path] + parts
+
+    def run_batch(
+        self,
+        jobs: Iterable[Union[str, CdoJob]],
+        max_cores: Optional[int] = None,
+        max_workers: Optional[int] = None,
+        threads_per_job: Optional[int] = None,
+        timeout: Optional[int] = None,
+        on_stderr: Optional[Callable[[int, str], None]] = None,
+    ) -> Iterator[CdoResult]:
+        """
+        Run many independent CDO commands concurrently.
+
+        The core budget is split between the number of CDO processes
+        running at the same time and the ``-P`` OpenMP threads of each
+        of them (see :func:`split_core_budget`), so a batch does not
+        oversubscribe the machine. Operator chains still run one
+        thread per operator inside each process on top of that.
+
+        Parameters
+        ----------
+        jobs : iterable of str or CdoJob
+            Command strings (as for :meth:`run_raw`) or job specs.
+        max_cores : int, optional
+            Core budget of the whole batch. Defaults to ``os.cpu_count()``.
+        max_workers : int, optional
+            Upper limit for the number of concurrent CDO processes.
+        threads_per_job : int, optional
+            Fixed ``-P`` value per process. By default the budget is
+            spread evenly over the jobs.
+        timeout : int, optional
+            Timeout in seconds for each job without its own timeout.
+        on_stderr : callable, optional
+            Called as ``on_stderr(index, line)`` for every stderr line
+            of every job while it runs, e.g. for progress display.
+            It is called from worker threads.
+
+        Returns
+        -------
+        iterator of CdoResult
+            One result per job in order of completion. ``result.index``
+            is the position of the job in *jobs*. Failed jobs are
+            yielded with ``result.error`` set instead of raising.
+            All jobs are submitted before this method returns, so they
+            run even if the iterator is not consumed. Closing the
+            iterator early cancels the jobs that have not started yet.
+        """
+        jobs = list(jobs)
+        if not jobs:
+            return iter(())
+
+        workers, threads = split_core_budget(len(jobs), max_cores, max_workers, threads_per_job)
+
+        if self.debug:
+            print(f"[skyborn-cdo] Batch: {len(jobs)} jobs, {workers} processes x -P {threads}")
+
+        def _run_job(index: int, job: Union[str, CdoJob]) -> CdoResult:
+            spec = job if isinstance(job, CdoJob) else CdoJob(cmd=job)
+            cmd = self._job_command(spec, threads)
+            label = spec.name or spec.cmd or " ".join(cmd)
+            job_timeout = spec.timeout if spec.timeout is not None else timeout
+            callback = None
+            if on_stderr is not None:
+                def callback(line, _index=index):
+                    on_stderr(_index, line)
+
+            if self.debug:
+                print(f"[skyborn-cdo] Running: {' '.join(cmd)}")
+
+            start = time.monotonic()
+            try:
+                result = self._exec(cmd, job_timeout, cmd_label=label,
+                                    output_file=spec.output_file or self._guess_output_file(cmd),
+                                    on_stderr=callback)
+            except CdoError as e:
+                return CdoResult(index, spec, cmd, e.returncode, stderr=e.stderr,
+                                 elapsed=time.monotonic() - start, error=e)
+
+            error = None
+            if result.returncode != 0:
+                error = CdoError(
+                    f"CDO command failed (exit code {result.returncode}):\n"
+                    f"  Command: {label}\n"
+                    f"  Error: {result.stderr.strip()}",
+                    returncode=result.returncode,
+                    stderr=result.stderr,
+                    cmd=label,
+                )
+            return CdoResult(index, spec, cmd, result.returncode, result.stdout, result.stderr,
+                             time.monotonic() - start, error)
+
+        # Submit eagerly, the jobs run even if the caller never iterates over the results
+        executor = ThreadPoolExecutor(max_workers=workers, thread_name_prefix="skyborn-cdo")
+        try:
+            futures = [executor.submit(_run_job, i, job) for i, job in enumerate(jobs)]
+        finally:
+            executor.shutdown(wait=False)
+
+        return self._iter_completed(futures)
+
+    @staticmethod
+    def _iter_completed(futures: list) -> Iterator[CdoResult]:
+        """Yield the results of *futures* as they complete."""
+        try:
+            for future in as_completed(futures):
+                yield future.result()
+        finally:
+            # Jobs not started yet are dropped if the caller stops iterating early
+            for future in futures:
+                future.cancel()
@@ -9,12 +9,156 @@ Provides two API styles:
 import glob
 import os
 import shlex
+import struct
 import subprocess
 import tempfile
-from typing import Any, Dict, List, Optional, Union
+from typing import Any, Callable, Dict, Iterable, Iterator, List, Optional, Tuple, Union
 
 from skyborn_cdo._cdo_binary import get_bundled_env, get_cdo_path
-from skyborn_cdo._runner import CdoError, CdoRunner
+from skyborn_cdo._runner import CdoError, CdoJob, CdoResult, CdoRunner
+
+
+# Header written by the outputraw operator, see "cdo -h outputraw"
+_RAW_HEADER = struct.Struct("=8sIIIIQQQQd64s")
+_RAW_MAGIC = b"CDORAW01"
+_RAW_GRID_2D = 1
+
+
+def _raw_tempdir() -> Optional[str]:
+    """Directory for raw array files, shared memory if available."""
+    shm = "/dev/shm"
+    if os.path.isdir(shm) and os.access(shm, os.W_OK):
+        return shm
+    return None
+
+
+# CDO options that take an argument, e.g. "-f nc4" or "-P 4"
+_OPTIONS_WITH_ARG = {
+    "-C", "-D", "-F", "-P", "-b", "-f", "-g", "-h", "-i", "-k", "-l", "-m", "-t", "-z",
+    "--color", "--chunktype", "--compression_type", "--default_datatype", "--filter",
+    "--format", "--grid", "--institution", "--num_threads", "--scoped_debug",
+    "--set_missval", "--table", "--zaxis",
+}
+
+
+def _option_units(options: List[str]) -> List[List[str]]:
+    """Group option tokens into single options with their argument."""
+    units: List[List[str]] = []
+    for token in options:
+        if units and units[-1][0] in _OPTIONS_WITH_ARG and len(units[-1]) == 1:
+            units[-1].append(token)
+        else:
+            units.append([token])
+    return units
+
+
+def _merge_options(options: List[str], extra: List[str]) -> List[str]:
+    """Append the options of *extra* that are not already in *options*."""
+    merged = list(options)
+    present = _option_units(options)
+    for unit in _option_units(extra):
+        if unit not in present:
+            merged.extend(unit)
+            present.append(unit)
+    return merged
+
+
+def _wants_result(kwargs: Dict[str, Any]) -> bool:
+    """True if an operator call asks for an output file or a return type."""
+    return kwargs.get("output") is not None or any(
+        kwargs.get(k) for k in ("returnCdf", "returnXArray", "returnXDataset",
+                                "returnArray", "returnMaArray"))
+
+
+class CdoChain:
+    """
+    Lazy result of an operator call made with ``lazy=True``.
+
+    Nothing runs until the chain is evaluated. Calling an operator on the
+    chain adds a stage, passing it as ``input`` of another call compiles
+    it into that call. Evaluation runs a single CDO command
+    ``-opN ... -op2 -op1 input`` whose stages are pipelined inside one
+    CDO process, so no intermediate files are written.
+
+    Examples
+    --------
+    >>> cdo = Cdo(options="-O")
+    >>> box = cdo.sellonlatbox("70,140,10,55", input="in.nc", lazy=True)
+    >>> box.fldmean().run(output="mean.nc")      # -fldmean -sellonlatbox,... in.nc
+    >>> box.fldmean(output="mean.nc")            # same, output= evaluates the chain
+    >>> ds = cdo.timmean(input=box, returnXArray=True)
+    >>> diff = cdo.sub(input=[box, box.timmean()], lazy=True)
+    """
+
+    def __init__(self, cdo: "Cdo", operator: str, op_str: str,
+                 input_tokens: List[str], options: List[str], num_inputs: int = 1):
+        self._cdo = cdo
+        self._operator = operator
+        self._op_str = op_str
+        self._input_tokens = input_tokens
+        self._options = options
+        self._num_inputs = num_inputs
+
+    @property
+    def operator(self) -> str:
+        """Name of the last operator of the chain."""
+        return self._operator
+
+    def tokens(self) -> List[str]:
+        """Command line tokens of the chain, without options and output."""
+        inputs = self._input_tokens
+        # Brackets keep the inputs of a stage apart from those of the enclosing one
+        if self._num_inputs > 1:
+            inputs = ["["] + inputs + ["]"]
+        return [self._op_str] + inputs
+
+    def options(self) -> List[str]:
+        """Per-call options collected from all stages."""
+        return list(self._options)
+
+    def run(self, output: Optional[str] = None, options: Optional[str] = None,
+            timeout: Optional[int] = None, **kwargs) -> Any:
+        """
+        Evaluate the chain as one CDO command.
+
+        Parameters
+        ----------
+        output : str, optional
+            Output file path.
+        options : str, optional
+            Additional options for this command.
+        timeout : int, optional
+            Override default timeout.
+        **kwargs
+            ``returnXArray``, ``returnCdf``, ``returnArray``, ... as for
+            operator calls.
+        """
+        cmd_options = _merge_options(list(self._cdo._default_options), self._options)
+        if options:
+            cmd_options.extend(shlex.split(options))
+        return self._cdo._execute(self._operator, self._op_str, self._input_tokens,
+                                  cmd_options, output, timeout=timeout, **kwargs)
+
+    def __getattr__(self, name: str):
+        """Add the named CDO operator as a new stage on top of this chain."""
+        if name.startswith("_"):
+            raise AttributeError(
+                f"'{type(self).__name__}' object has no attribute '{name}'")
+
+        def operator_method(*args, **kwargs):
+            # Asking for an output file or a return type evaluates the chain
+            kwargs.setdefault("lazy", not _wants_result(kwargs))
+            return self._cdo._execute_operator(name, *args, input=self, **kwargs)
+
+        operator_method.__name__ = name
+        operator_method.__doc__ = f"Add CDO operator {name} to the chain"
+        return operator_method
+
+    def __str__(self) -> str:
+        return " ".join(self.options() + self.tokens())
+
+    def __repr__(self) -> str:
+        return f"CdoChain('{self}')"
 
 
 class Cdo:
@@ -134,6 +278,42 @@ class Cdo:
             return result.stdout.strip()
         return 0
 
+    def run_batch(
+        self,
+        jobs: Iterable[Union[str, CdoJob]],
+        max_cores: Optional[int] = None,
+        max_workers: Optional[int] = None,
+        threads_per_job: Optional[int] = None,
+        timeout: Optional[int] = None,
+        on_stderr: Optional[Callable[[int, str], None]] = None,
+    ) -> Iterator[CdoResult]:
+        """
+        Run many independent CDO commands concurrently within a core budget.
+
+        Command strings use the same syntax as ``cdo("...")``. Each CDO
+        process gets a share of the budget as ``-P`` threads. The jobs start
+        right away; the returned iterator yields the results as the jobs
+        complete, and failed jobs carry ``result.error``.
+
+        Examples
+        --------
+        >>> cdo = Cdo(options="-O")
+        >>> jobs = [f"-O yearmean -selyear,{y} in.nc mean_{y}.nc" for y in range(1980, 2020)]
+        >>> for result in cdo.run_batch(jobs, max_cores=32):
+        ...     if not result.ok:
+        ...         print(result.error)
+
+        See :meth:`CdoRunner.run_batch` for the parameters.
+        """
+        return self._runner.run_batch(
+            jobs,
+            max_cores=max_cores,
+            max_workers=max_workers,
+            threads_per_job=threads_per_job,
+            timeout=timeout or self._timeout,
+            on_stderr=on_stderr,
+        )
+
     def __getattr__(self, name: str):
         """
         Dynamically dispatch CDO operators as method calls.
@@ -172,7 +352,9 @@ class Cdo:
         returnXDataset: bool = False,
         returnArray: bool = False,
         returnMaArray: bool = False,
+        raw: bool = False,
         timeout: Optional[int] = None,
+        lazy: bool = False,
         **kwargs,
     ) -> Any:
         """
@@ -184,8 +366,10 @@ class Cdo:
             CDO operator name.
         *args : str
             Operator parameters (e.g. "0,30,0,30" for sellonlatbox).
-        input : str or list of str, optional
+        input : str, CdoChain or list, optional
             Input file(s). Can be a space-separated string or list.
+            Lazy results (:class:`CdoChain`) are compiled into the
+            operator chain of this call instead of being run first.
         output : str, optional
             Output file path. If returnXArray/returnCdf, a tempfile is used.
         options : str, optional
@@ -198,14 +382,23 @@ class Cdo:
             If True, return result as numpy array (first variable).
         returnMaArray : bool
             If True, return result as masked numpy array (first variable).
+        raw : bool
+            With returnArray/returnMaArray: let CDO write the variable as
+            a raw binary array (operator ``outputraw``) and map it into
+            memory instead of writing and reading a NetCDF file. The shape
+            is (time, [level,] y, x) or (time, [level,] cell).
         timeout : int, optional
             Override default timeout.
+        lazy : bool
+            If True, do not run CDO but return a :class:`CdoChain` that
+            records this call. Chains are run as one CDO command with
+            ``-op1 -op2 ...`` when evaluated, without intermediate files.
 
         Returns
         -------
         Various
             Depending on return* flags: xarray.Dataset, netCDF4.Dataset,
-            numpy.ndarray, stdout string, or 0 on success.
+            numpy.ndarray, stdout string, CdoChain (lazy), or 0 on success.
         """
         # Build the operator string with parameters
         operator_params = ",".join(str(a) for a in args) if args else ""
@@ -214,49 +407,118 @@ class Cdo:
         else:
             op_str = f"-{operator}"
 
+        input_files, chain_options, num_inputs = self._input_tokens(input)
+
+        if lazy:
+            if output is not None or returnCdf or returnXArray or returnXDataset or returnArray or returnMaArray:
+                raise ValueError("lazy=True cannot be combined with output or return* arguments")
+            call_options = shlex.split(options) if options else []
+            return CdoChain(self, operator, op_str, input_files,
+                            _merge_options(chain_options, call_options), num_inputs)
+
         # Merge options
-        cmd_options = list(self._default_options)
+        cmd_options = _merge_options(list(self._default_options), chain_options)
         if options:
             cmd_options.extend(shlex.split(options))
 
-        # Process input files
-        input_files = []
-        if input is not None:
-            if isinstance(input, (list, tuple)):
-                input_files = [str(f) for f in input]
-            elif isinstance(input, str):
+        return self._execute(operator, op_str, input_files, cmd_options, output,
+                             returnCdf=returnCdf, returnXArray=returnXArray,
+                             returnXDataset=returnXDataset, returnArray=returnArray,
+                             returnMaArray=returnMaArray, raw=raw, timeout=timeout)
+
+    def _input_tokens(self, input) -> Tuple[List[str], List[str], int]:
+        """
+        Convert the ``input`` argument of an operator call to command line
+        tokens.
+
+        Returns the tokens, the options recorded by lazy chains in the
+        input, which apply to the whole command, and the number of inputs
+        (a lazy chain or a string with operators counts as one).
+        """
+        if input is None:
+            return [], [], 0
+
+        is_list = isinstance(input, (list, tuple))
+        items = list(input) if is_list else [input]
+
+        tokens: List[str] = []
+        chain_options: List[str] = []
+        num_inputs = 0
+        for item in items:
+            if isinstance(item, CdoChain):
+                tokens.extend(item.tokens())
+                chain_options = _merge_options(chain_options, item.options())
+                num_inputs += 1
+            elif is_list:
+                files = self._expand_globs([str(item)])
+                tokens.extend(files)
+                num_inputs += len(files)
+            elif isinstance(item, str):
                 # On Windows, shlex.split with default posix=True eats backslashes.
                 # Use posix=False on Windows to preserve path separators.
                 if os.name == 'nt':
-                    input_files = shlex.split(input, posix=False)
+                    parts = shlex.split(item, posix=False)
                     # Remove surrounding quotes that shlex leaves in posix=False mode
-                    input_files = [f.strip('"').strip("'")
-                                   for f in input_files]
+                    parts = [f.strip('"').strip("'") for f in parts]
                 else:
-                    input_files = shlex.split(str(input))
+                    parts = shlex.split(item)
+                parts = self._expand_globs(parts)
+                tokens.extend(parts)
+                num_inputs += 1 if any(p.startswith("-") for p in parts) else len(parts)
             else:
-                input_files = [str(input)]
-
-        # Expand glob/wildcard patterns (e.g. "*.nc", "data_202?.nc")
-        if input_files:
-            expanded = []
-            for f in input_files:
-                if any(c in f for c in ("*", "?", "[", "]")):
-                    matches = sorted(glob.glob(f))
-                    if matches:
-                        expanded.extend(matches)
-                    else:
-                        # No match — keep original so CDO reports the error
-                        expanded.append(f)
+                tokens.append(str(item))
+                num_inputs += 1
+
+        return tokens, chain_options, num_inputs
+
+    @staticmethod
+    def _expand_globs(input_files: List[str]) -> List[str]:
+        """Expand glob/wildcard patterns (e.g. "*.nc", "data_202?.nc")."""
+        expanded = []
+        for f in input_files:
+            if any(c in f for c in ("*", "?", "[", "]")):
+                matches = sorted(glob.glob(f))
+                if matches:
+                    expanded.extend(matches)
                 else:
+                    # No match — keep original so CDO reports the error
                     expanded.append(f)
-            input_files = expanded
+            else:
+                expanded.append(f)
+        return expanded
 
+    def _execute(
+        self,
+        operator: str,
+        op_str: str,
+        input_files: List[str],
+        cmd_options: List[str],
+        output: Optional[str] = None,
+        returnCdf: bool = False,
+        returnXArray: bool = False,
+        returnXDataset: bool = False,
+        returnArray: bool = False,
+        returnMaArray: bool = False,
+        raw: bool = False,
+        timeout: Optional[int] = None,
+    ) -> Any:
+        """Run ``op_str`` (possibly a compiled chain) on *input_files*."""
         # Handle return types that need a temp file
         need_output_file = returnXArray or returnXDataset or returnCdf or returnArray or returnMaArray
+        raw = raw and (returnArray or returnMaArray) and not (returnXArray or returnXDataset or returnCdf)
         temp_output = None
-
-        if need_output_file and output is None:
+        args = [op_str]
+
+        if raw:
+            # CDO writes the first variable as a raw array, no NetCDF encoding
+            args = ["-outputraw", op_str]
+            if output is None:
+                temp_output = tempfile.NamedTemporaryFile(
+                    suffix=".raw", prefix="skyborn_cdo_", dir=_raw_tempdir(), delete=False
+                )
+                temp_output.close()
+                output = temp_output.name
+        elif need_output_file and output is None:
             temp_output = tempfile.NamedTemporaryFile(
                 suffix=".nc", prefix="skyborn_cdo_", delete=False
             )
@@ -288,7 +550,7 @@ class Cdo:
         # Build and execute command
         try:
             result = self._runner.run(
-                args=[op_str],
+                args=args,
                 input_files=input_files,
                 output_file=output,
                 options=cmd_options,
@@ -302,7 +564,13 @@ class Cdo:
             raise
 
         # Handle return types
-        if returnXArray or returnXDataset:
+        if raw:
+            try:
+                return self._return_raw_array(output, masked=returnMaArray)
+            finally:
+                if temp_output:
+                    self._release_raw_file(output)
+        elif returnXArray or returnXDataset:
             return self._return_xarray(output)
         elif returnCdf:
             return self._return_cdf(output)
@@ -358,6 +626,52 @@ class Cdo:
                         return np.asarray(var[:])
             raise CdoError(f"No data variables found in {filepath}")
 
+    def _return_raw_array(self, filepath: str, masked: bool = False):
+        """Map the output of the outputraw operator as numpy array without copying."""
+        try:
+            import numpy as np
+        except ImportError:
+            raise ImportError(
+                "numpy is required for returnArray. "
+                "Install with: pip install numpy"
+            )
+        with open(filepath, "rb") as f:
+            header = f.read(_RAW_HEADER.size)
+        if len(header) < _RAW_HEADER.size or header[:8] != _RAW_MAGIC:
+            raise CdoError(f"No raw array found in {filepath}")
+
+        (_, header_size, item_size, flags, _, num_steps, nlev, ny, nx,
+         missval, _) = _RAW_HEADER.unpack(header)
+
+        dtype = np.dtype(np.float64 if item_size == 8 else np.float32)
+        field_shape = (ny, nx) if flags & _RAW_GRID_2D else (nx,)
+        shape = (num_steps,) + ((nlev,) if nlev > 1 else ()) + field_shape
+
+        if num_steps == 0:
+            data = np.empty(shape, dtype=dtype)
+        else:
+            # Copy-on-write mapping: writable for the caller, the file stays unchanged
+            data = np.memmap(filepath, dtype=dtype, mode="c", offset=header_size, shape=shape)
+
+        if masked:
+            if np.isnan(missval):
+                return np.ma.masked_invalid(data, copy=False)
+            return np.ma.masked_equal(data, dtype.type(missval), copy=False)
+        return data
+
+    def _release_raw_file(self, filepath: str):
+        """Remove a temporary raw array file once it is mapped.
+
+        On POSIX the mapping keeps the data alive after the unlink. Where a
+        mapped file can't be removed (Windows), it is left to cleanup().
+        """
+        try:
+            os.unlink(filepath)
+        except FileNotFoundError:
+            pass
+        except OSError:
+            self._tempfiles.append(filepath)
+
     def version(self) -> str:
         """Return CDO version string."""
         from skyborn_cdo._cdo_binary import get_cdo_version
@@ -430,12 +744,14 @@ class Cdo:
                 "Chained operators:\n"
                 '  cdo("-O -fldmean -sellonlatbox,70,140,10,55 in.nc out.nc")\n'
                 '  cdo.fldmean(input="-sellonlatbox,70,140,10,55 in.nc", output="out.nc")\n'
+                '  cdo.sellonlatbox("70,140,10,55", input="in.nc", lazy=True).fldmean(output="out.nc")\n'
                 "\n"
                 "Useful methods:\n"
                 '  cdo.help("operator")  - help for a specific operator\n'
                 "  cdo.operators()       - set of all available operators\n"
                 '  cdo.has_operator("x") - check if operator exists\n'
                 "  cdo.version()         - CDO version string\n"
+                "  cdo.run_batch(jobs)   - run many commands concurrently\n"
                 "\n"
                 "Common options: -O (overwrite), -s (silent), -f nc4 (format)\n"
                 '  cdo = Cdo(options="-O -s")\n'
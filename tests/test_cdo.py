@@ -6,6 +6,7 @@ import os
 import subprocess
 import sys
 import tempfile
+import time
 
 import pytest
 
@@ -92,6 +93,72 @@ class TestCdoRunner:
         with pytest.raises(CdoError, match="CDO binary not found"):
             runner.run(["--version"])
 
+    def test_split_core_budget(self):
+        """Test splitting cores between processes and -P threads."""
+        from skyborn_cdo._runner import split_core_budget
+
+        assert split_core_budget(10, max_cores=128) == (10, 12)
+        assert split_core_budget(500, max_cores=128) == (128, 1)
+        assert split_core_budget(10, max_cores=16, threads_per_job=4) == (4, 4)
+        assert split_core_budget(10, max_cores=128, max_workers=2) == (2, 64)
+        assert split_core_budget(1, max_cores=1, threads_per_job=8) == (1, 1)
+
+    def test_run_batch(self):
+        """Test batch execution with a Python interpreter as stand-in binary."""
+        from skyborn_cdo._runner import CdoJob, CdoRunner
+
+        runner = CdoRunner(sys.executable)
+        jobs = [
+            CdoJob(args=["-c", "import sys; sys.stderr.write('step 1\\nstep 2\\n')"]),
+            CdoJob(args=["-c", "print('hello')"], name="hello"),
+            CdoJob(args=["-c", "import sys; sys.exit(3)"]),
+        ]
+        lines = []
+        results = list(runner.run_batch(jobs, max_cores=2, threads_per_job=1,
+                                        on_stderr=lambda i, line: lines.append((i, line))))
+
+        assert sorted(r.index for r in results) == [0, 1, 2]
+        by_index = {r.index: r for r in results}
+        assert by_index[0].ok
+        assert (0, "step 1\n") in lines and (0, "step 2\n") in lines
+        assert by_index[1].stdout.strip() == "hello"
+        assert not by_index[2].ok
+        assert by_index[2].returncode == 3
+
+    def test_run_batch_threads_option(self):
+        """Test that -P is only added when the job has none."""
+        from skyborn_cdo._runner import CdoJob, CdoRunner
+
+        runner = CdoRunner("cdo")
+        assert runner._job_command("copy in.nc out.nc", 4)[1:3] == ["-P", "4"]
+        assert runner._job_command("-P 2 copy in.nc out.nc", 4).count("-P") == 1
+        assert "-P" not in runner._job_command(CdoJob(args=["-copy"]), 1)
+
+    def test_run_batch_submits_eagerly(self, tmp_path):
+        """Test that the jobs run without iterating over the results."""
+        from skyborn_cdo._runner import CdoJob, CdoRunner
+
+        marker = tmp_path / "ran"
+        runner = CdoRunner(sys.executable)
+        results = runner.run_batch([CdoJob(args=["-c", f"open({str(marker)!r}, 'w')"])], max_cores=1)
+        for _ in range(100):
+            if marker.exists():
+                break
+            time.sleep(0.05)
+        assert marker.exists()
+        assert [r.ok for r in results] == [True]
+
+    def test_exec_streaming_timeout(self):
+        """Test that a streaming timeout keeps the stderr read so far."""
+        from skyborn_cdo._runner import CdoError, CdoRunner
+
+        runner = CdoRunner(sys.executable)
+        cmd = [sys.executable, "-c",
+               "import sys, time; sys.stderr.write('partial\\n'); sys.stderr.flush(); time.sleep(30)"]
+        with pytest.raises(CdoError) as excinfo:
+            runner._exec(cmd, 1, on_stderr=lambda line: None)
+        assert excinfo.value.stderr == "partial\n"
+
 
 class TestCdoClass:
     """Test the high-level Cdo class."""
@@ -148,6 +215,20 @@ class TestCdoClass:
         result = cdo("cdo --version")
         assert isinstance(result, (str, int))
 
+    def test_lazy_chain(self, cdo):
+        """Test that lazy calls compile into one operator chain."""
+        box = cdo.sellonlatbox("0,30,0,30", input="in.nc", lazy=True)
+        assert str(box) == "-sellonlatbox,0,30,0,30 in.nc"
+
+        chain = box.fldmean().timmean(options="-f nc4")
+        assert str(chain) == "-f nc4 -timmean -fldmean -sellonlatbox,0,30,0,30 in.nc"
+
+        diff = cdo.sub(input=[box, "ref.nc"], lazy=True)
+        assert diff.tokens() == ["-sub", "[", "-sellonlatbox,0,30,0,30", "in.nc", "ref.nc", "]"]
+
+        with pytest.raises(ValueError):
+            cdo.fldmean(input="in.nc", output="out.nc", lazy=True)
+
     def test_cleanup(self, cdo):
         """Test cleanup removes temp files."""
         cdo._tempfiles.append("/tmp/nonexistent_test_file.nc")
@@ -223,6 +304,67 @@ class TestCdoOperations:
         result = cdo.showname(input=sample_nc)
         assert isinstance(result, str)
 
+    def test_return_raw_array(self, cdo, sample_nc):
+        """Test returning arrays through the raw binary output of CDO."""
+        np = pytest.importorskip("numpy")
+        if not cdo.has_operator("outputraw"):
+            pytest.skip("CDO has no outputraw operator")
+
+        arr = cdo.copy(input=sample_nc, returnArray=True, raw=True)
+        assert isinstance(arr, np.ndarray)
+        assert arr.ndim == 3 and arr.shape[0] == 1
+
+        marr = cdo.setrtomiss(-1e9, 0, input=sample_nc, returnMaArray=True, raw=True)
+        assert marr.shape == arr.shape
+        assert marr.mask.any()
+        assert (marr.compressed() > 0).all()
+
+        # The raw files are unlinked as soon as they are mapped
+        if os.name != "nt":
+            assert not cdo._tempfiles
+
+    def test_return_raw_array_nan_missval(self, cdo, tmp_path):
+        """Test masking a raw array whose missing value is NaN."""
+        np = pytest.importorskip("numpy")
+        from skyborn_cdo.cdo import _RAW_HEADER, _RAW_MAGIC
+
+        values = np.array([[1.0, np.nan, 3.0]], dtype=np.float32)
+        rawfile = tmp_path / "nan.raw"
+        header = _RAW_HEADER.pack(_RAW_MAGIC, _RAW_HEADER.size, 4, 0, 0, 1, 1, 1, 3, float("nan"), b"var")
+        rawfile.write_bytes(header + values.tobytes())
+
+        marr = cdo._return_raw_array(str(rawfile), masked=True)
+        assert marr.mask.tolist() == [[False, True, False]]
+        assert marr.compressed().tolist() == [1.0, 3.0]
+
+    def test_lazy_chain_run(self, cdo, sample_nc, tmp_path):
+        """Test evaluating a lazy chain as a single command."""
+        outfile = str(tmp_path / "chain_out.nc")
+        chain = cdo.mulc(2, input=sample_nc, lazy=True).addc(1)
+        chain.fldmean(output=outfile)
+        assert os.path.getsize(outfile) > 0
+
+        outfile2 = str(tmp_path / "chain_out2.nc")
+        cdo.fldmean(input=cdo.sub(input=[chain, sample_nc], lazy=True), output=outfile2)
+        assert os.path.getsize(outfile2) > 0
+        assert cdo._tempfiles == []
+
+    def test_run_batch(self, cdo, sample_nc, tmp_path):
+        """Test concurrent batch execution of several commands."""
+        outfiles = [str(tmp_path / f"batch_{i}.nc") for i in range(4)]
+        jobs = [f"-O copy {sample_nc} {f}" for f in outfiles]
+        jobs.append(f"-O copy {tmp_path / 'missing.nc'} {tmp_path / 'never.nc'}")
+
+        results = list(cdo.run_batch(jobs, max_cores=2))
+
+        assert len(results) == 5
+        for r in results:
+            if r.index < 4:
+                assert r.ok, r.error
+                assert os.path.getsize(outfiles[r.index]) > 0
+            else:
+                assert not r.ok
+
 
 class TestCli:
     """Test CLI entry point."""